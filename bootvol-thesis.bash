@@ -73,30 +73,17 @@ if [ 1 == 1 ]; then
 
 	DebugEcho $TERSE $LINENO "Processing $group"
 
-	if [ ! -e ${group}-boot.xyz.vmax ]; then 
-	    if [ ! -e ${group}.s ]; then
-		echo "ERROR: ${group}.s is missing.  Goodbye."
-		exit $EXIT_FAILURE
-	    fi
-	    s_bootstrap ${group}.s -f xyz  -n 3 --out ${group}.xyz. -p --draw ${draw} -v $debugLevel
-	    mv ${group}.xyz.1.vmax ${group}-boot.xyz.vmax
-	    mv ${group}.xyz.2.vint ${group}-boot.xyz.vint
-	    mv ${group}.xyz.3.vmin ${group}-boot.xyz.vmin
-	else
-	    DebugEcho $TERSE $LINENO "Using existing bootstrapped xyz's"
+	if [ ! -e ${group}.s ]; then
+	    echo "ERROR: ${group}.s is missing.  Goodbye."
+	    exit $EXIT_FAILURE
 	fi
 
-	DebugEcho $TRACE $LINENO  Densifying:  calling xyzdensity 4 times
+	DebugEcho $TRACE $LINENO  Bootstrapping straight into volumes
 
-	args=" -p 1  --bpv=16 -w ${cells} -t ${cells} -d ${cells} --verbosity=$debugLevel"
-	
- 	xyzdensity ${group}-boot.xyz.vmax --out=${group}-vmax.vol $args $boundaries
- 	xyzdensity ${group}-boot.xyz.vint --out=${group}-vint.vol $args $boundaries
- 	xyzdensity ${group}-boot.xyz.vmin --out=${group}-vmin.vol $args $boundaries
- 	xyzdensity --out=${group}-all.vol -p 1 -b 8 -w ${cells} -t ${cells} -d ${cells} $boundaries \
- 	    ${group}-boot.xyz.vmax \
- 	    ${group}-boot.xyz.vint \
- 	    ${group}-boot.xyz.vmin 
+	# Same as s_bootstrap -f xyz -n 3 followed by xyzdensity 4 times
+	s_bootvol ${group}.s --out=${group} --sample --draw=${draw} -v $debugLevel \
+	    -p 1 --bpv=16 -w ${cells} -t ${cells} -d ${cells} $boundaries \
+	    --all --all-pack=1 --all-bpv=8
 	
 	if [ ! -e current.cmap ]; then 
 	    volmakecmap --cpt=rgba.cpt -o current.cmap --zero=0